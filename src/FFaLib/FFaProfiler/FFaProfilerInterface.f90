@@ -30,6 +30,10 @@ module FFaProfilerInterface
      subroutine ffa_reporttimer ()
      end subroutine ffa_reporttimer
 
+     subroutine ffa_writetrace (prefix)
+       character(len=*), intent(in) :: prefix
+     end subroutine ffa_writetrace
+
      subroutine ffa_getmemusage (usage)
        integer , parameter   :: sp = kind(1.0)
        real(sp), intent(out) :: usage(4)